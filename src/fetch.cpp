@@ -3,10 +3,12 @@
 #include <string>
 #include <regex>
 #include <sstream>
+#include <functional>
 std::string returnedAdvice;
 std::string returnedAdviceId;
 
 static std::function<void(std::string, std::string)> g_callback;
+static std::function<void()> g_errorCallback;
 
 void on_success(emscripten_fetch_t *fetch)
 {
@@ -39,11 +41,17 @@ void on_success(emscripten_fetch_t *fetch)
 void on_error(emscripten_fetch_t *fetch)
 {
     emscripten_fetch_close(fetch);
+
+    if (g_errorCallback)
+    {
+        g_errorCallback();
+    }
 }
 
-void perform_fetch(std::function<void(std::string, std::string)> callback)
+void perform_fetch(std::function<void(std::string, std::string)> callback, std::function<void()> errorCallback = nullptr)
 {
     g_callback = callback;
+    g_errorCallback = errorCallback;
 
     emscripten_fetch_attr_t attr;
     emscripten_fetch_attr_init(&attr);
@@ -0,0 +1,304 @@
+#include <SDL2/SDL.h>
+#include <emscripten/html5.h>
+#include <GLES3/gl3.h>
+#include <vector>
+
+// WebGL2 background: stars are uploaded once, lensing and veil falloff run in shaders.
+// Drawn on #gl-canvas behind the SDL canvas, which is cleared transparent while this path is active.
+
+const char *starVertexShader = R"(#version 300 es
+layout(location = 0) in vec4 a_star; // x, y, speed, size
+layout(location = 1) in float a_wraps; // wraps already folded into x on the CPU
+uniform vec2 u_screen;
+uniform float u_frame;
+uniform vec3 u_wormhole; // x, y, baseRadius
+
+float hash(float n)
+{
+    return fract(sin(n) * 43758.5453);
+}
+
+void main()
+{
+    float travelled = a_star.x + a_star.z * u_frame;
+    float wraps = a_wraps + floor(travelled / u_screen.x);
+    vec2 pos = vec2(mod(travelled, u_screen.x), a_star.y);
+    if (wraps > 0.0)
+        pos.y = floor(hash(float(gl_VertexID) * 1.7 + wraps) * u_screen.y);
+
+    vec2 d = pos - u_wormhole.xy;
+    float dist = length(d);
+    float radius = u_wormhole.z * 2.5;
+    if (dist < radius && dist > 0.0)
+        pos += d / dist * 100.0 * pow(1.0 - dist / radius, 2.0);
+
+    vec2 center = floor(pos) + a_star.w * 0.5;
+    gl_Position = vec4(center / u_screen * 2.0 - 1.0, 0.0, 1.0) * vec4(1.0, -1.0, 1.0, 1.0);
+    gl_PointSize = a_star.w;
+}
+)";
+
+const char *starFragmentShader = R"(#version 300 es
+precision mediump float;
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = vec4(1.0);
+}
+)";
+
+const char *wormholeVertexShader = R"(#version 300 es
+layout(location = 0) in vec2 a_corner;
+uniform vec2 u_screen;
+uniform vec3 u_wormhole;
+uniform float u_extent;
+out vec2 v_offset;
+
+void main()
+{
+    v_offset = a_corner * u_extent;
+    vec2 pos = u_wormhole.xy + v_offset;
+    gl_Position = vec4(pos / u_screen * 2.0 - 1.0, 0.0, 1.0) * vec4(1.0, -1.0, 1.0, 1.0);
+}
+)";
+
+// Same veils as renderWormhole: each one is an annulus past the core, so the alpha
+// at a given radius is every veil covering it composited on top of each other
+const char *wormholeFragmentShader = R"(#version 300 es
+precision mediump float;
+in vec2 v_offset;
+uniform float u_core;
+out vec4 fragColor;
+
+void main()
+{
+    float r = length(v_offset);
+    if (r <= u_core)
+    {
+        fragColor = vec4(0.0, 0.0, 0.0, 1.0);
+        return;
+    }
+
+    float transmission = 1.0;
+    for (int i = 0; i < 10; i++)
+    {
+        float t = float(i) / 9.0;
+        float radius = u_core + u_core * 0.4 * t;
+        if (r <= radius + 2.0 * t)
+            transmission *= 1.0 - floor(178.0 * (1.0 - t)) / 255.0;
+    }
+    fragColor = vec4(0.0, 0.0, 0.0, 1.0 - transmission);
+}
+)";
+
+EMSCRIPTEN_WEBGL_CONTEXT_HANDLE glContext = 0;
+GLuint starProgram, wormholeProgram;
+GLuint starVao, starVbo, wormholeVao, wormholeVbo;
+GLint starScreenLoc, starFrameLoc, starWormholeLoc;
+GLint wormholeScreenLoc, wormholeWormholeLoc, wormholeExtentLoc, wormholeCoreLoc;
+GLsizei glStarCount = 0;
+std::vector<float> glStarData; // x, y, speed, size, wraps per star
+float glFrame = 0;
+
+// Frames after which star travel is folded back into glStarData, keeping u_frame small enough for float precision
+const float glFoldInterval = 3600;
+int glCanvasW = 0, glCanvasH = 0;
+
+GLuint compileShader(GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint ok;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok)
+    {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        SDL_Log("gl_background: shader compile failed: %s", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+GLuint linkProgram(const char *vertexSource, const char *fragmentSource)
+{
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    if (!vs || !fs)
+        return 0;
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint ok;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok)
+    {
+        SDL_Log("gl_background: program link failed");
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+// SDL still believes its own context is current, so every entry point restores it before returning
+bool initGLBackground(const char *canvasSelector)
+{
+    EmscriptenWebGLContextAttributes attrs;
+    emscripten_webgl_init_context_attributes(&attrs);
+    attrs.majorVersion = 2;
+    attrs.minorVersion = 0;
+    attrs.alpha = false;
+    attrs.depth = false;
+    attrs.stencil = false;
+    attrs.antialias = false;
+
+    EMSCRIPTEN_WEBGL_CONTEXT_HANDLE prevContext = emscripten_webgl_get_current_context();
+    glContext = emscripten_webgl_create_context(canvasSelector, &attrs);
+    if (glContext <= 0)
+    {
+        glContext = 0;
+        return false;
+    }
+    emscripten_webgl_make_context_current(glContext);
+
+    starProgram = linkProgram(starVertexShader, starFragmentShader);
+    wormholeProgram = linkProgram(wormholeVertexShader, wormholeFragmentShader);
+    if (!starProgram || !wormholeProgram)
+    {
+        emscripten_webgl_make_context_current(prevContext);
+        emscripten_webgl_destroy_context(glContext);
+        glContext = 0;
+        return false;
+    }
+
+    starScreenLoc = glGetUniformLocation(starProgram, "u_screen");
+    starFrameLoc = glGetUniformLocation(starProgram, "u_frame");
+    starWormholeLoc = glGetUniformLocation(starProgram, "u_wormhole");
+    wormholeScreenLoc = glGetUniformLocation(wormholeProgram, "u_screen");
+    wormholeWormholeLoc = glGetUniformLocation(wormholeProgram, "u_wormhole");
+    wormholeExtentLoc = glGetUniformLocation(wormholeProgram, "u_extent");
+    wormholeCoreLoc = glGetUniformLocation(wormholeProgram, "u_core");
+
+    glGenVertexArrays(1, &starVao);
+    glGenBuffers(1, &starVbo);
+    glBindVertexArray(starVao);
+    glBindBuffer(GL_ARRAY_BUFFER, starVbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 5 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void *)(4 * sizeof(float)));
+
+    const float corners[] = {-1, -1, 1, -1, -1, 1, 1, 1};
+    glGenVertexArrays(1, &wormholeVao);
+    glGenBuffers(1, &wormholeVbo);
+    glBindVertexArray(wormholeVao);
+    glBindBuffer(GL_ARRAY_BUFFER, wormholeVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+    glBindVertexArray(0);
+
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    emscripten_webgl_make_context_current(prevContext);
+    return true;
+}
+
+// Expects the GL context to be current
+void uploadGLStarData()
+{
+    glBindBuffer(GL_ARRAY_BUFFER, starVbo);
+    glBufferData(GL_ARRAY_BUFFER, glStarData.size() * sizeof(float), glStarData.data(), GL_STATIC_DRAW);
+    glStarCount = glStarData.size() / 5;
+    glFrame = 0;
+}
+
+// Called whenever initStars reseeds the field; stars then advance purely from u_frame
+void uploadGLStars(const std::vector<Star> &starField)
+{
+    if (!glContext)
+        return;
+
+    glStarData.clear();
+    glStarData.reserve(starField.size() * 5);
+    for (const Star &s : starField)
+    {
+        glStarData.push_back(s.x);
+        glStarData.push_back(s.y);
+        glStarData.push_back(s.speed);
+        glStarData.push_back(s.size);
+        glStarData.push_back(0);
+    }
+
+    EMSCRIPTEN_WEBGL_CONTEXT_HANDLE prevContext = emscripten_webgl_get_current_context();
+    emscripten_webgl_make_context_current(glContext);
+    uploadGLStarData();
+    emscripten_webgl_make_context_current(prevContext);
+}
+
+// Moves the travel so far into each star's x and wrap count, mirroring the vertex shader
+void foldGLStars(int screenWidth)
+{
+    for (size_t i = 0; i < glStarData.size(); i += 5)
+    {
+        float travelled = glStarData[i] + glStarData[i + 2] * glFrame;
+        float wraps = floor(travelled / screenWidth);
+        glStarData[i] = travelled - wraps * screenWidth;
+        glStarData[i + 4] += wraps;
+    }
+    uploadGLStarData();
+}
+
+void renderGLBackground(int screenWidth, int screenHeight, const Wormhole &wh)
+{
+    if (!glContext)
+        return;
+
+    EMSCRIPTEN_WEBGL_CONTEXT_HANDLE prevContext = emscripten_webgl_get_current_context();
+    emscripten_webgl_make_context_current(glContext);
+
+    if (screenWidth != glCanvasW || screenHeight != glCanvasH)
+    {
+        glCanvasW = screenWidth;
+        glCanvasH = screenHeight;
+        emscripten_set_canvas_element_size("#gl-canvas", screenWidth, screenHeight);
+        glViewport(0, 0, screenWidth, screenHeight);
+    }
+
+    if (glFrame >= glFoldInterval)
+        foldGLStars(screenWidth);
+
+    glClearColor(32 / 255.0f, 39 / 255.0f, 51 / 255.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glDisable(GL_BLEND);
+    glUseProgram(starProgram);
+    glUniform2f(starScreenLoc, screenWidth, screenHeight);
+    glUniform1f(starFrameLoc, glFrame);
+    glUniform3f(starWormholeLoc, wh.x, wh.y, wh.baseRadius);
+    glBindVertexArray(starVao);
+    glDrawArrays(GL_POINTS, 0, glStarCount);
+
+    float coreRadius = wh.baseRadius * 0.9f;
+    glEnable(GL_BLEND);
+    glUseProgram(wormholeProgram);
+    glUniform2f(wormholeScreenLoc, screenWidth, screenHeight);
+    glUniform3f(wormholeWormholeLoc, wh.x, wh.y, wh.baseRadius);
+    glUniform1f(wormholeExtentLoc, coreRadius * 1.4f + 3.0f);
+    glUniform1f(wormholeCoreLoc, coreRadius);
+    glBindVertexArray(wormholeVao);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glBindVertexArray(0);
+
+    emscripten_webgl_make_context_current(prevContext);
+    glFrame++;
+}
@@ -0,0 +1,169 @@
+#include <SDL2/SDL.h>
+#include <vector>
+
+enum HitRegionId
+{
+    HIT_NONE = -1,
+    HIT_BUTTON,
+    HIT_CARD,
+};
+
+struct HitRegion
+{
+    int id;
+    SDL_Rect bounds;
+    bool round;
+};
+
+// Pointer state coalesced over all events drained in one frame
+struct PointerFrame
+{
+    int x = -1, y = -1;
+    bool moved = false;
+    bool pressed = false;
+    int pressX = 0, pressY = 0;
+    Uint32 pressTicks = 0;
+    bool quit = false;
+};
+
+std::vector<HitRegion> hitRegions;
+PointerFrame pointer;
+int hoveredRegion = HIT_NONE;
+bool backendToggleRequested = false;
+bool hitRegionsDirty = true;
+SDL_Cursor *activeCursor = nullptr;
+Uint32 lastFingerTicks = 0;
+bool fingerSeen = false;
+
+// Browsers replay a tap as mousemove/mousedown after touchend; those arrive as real mouse events
+const Uint32 touchMouseGuardMs = 500;
+
+bool isTouchEcho(Uint32 which, Uint32 timestamp)
+{
+    if (which == SDL_TOUCH_MOUSEID)
+        return true;
+    return fingerSeen && timestamp - lastFingerTicks < touchMouseGuardMs;
+}
+
+// Regions are listed front to back; the first one containing the point wins
+void setHitRegion(int id, SDL_Rect bounds, bool round)
+{
+    for (HitRegion &region : hitRegions)
+    {
+        if (region.id != id)
+            continue;
+        if (region.bounds.x != bounds.x || region.bounds.y != bounds.y || region.bounds.w != bounds.w || region.bounds.h != bounds.h)
+        {
+            region.bounds = bounds;
+            hitRegionsDirty = true;
+        }
+        return;
+    }
+    hitRegions.push_back({id, bounds, round});
+    hitRegionsDirty = true;
+}
+
+int hitTest(int x, int y)
+{
+    for (const HitRegion &region : hitRegions)
+    {
+        const SDL_Rect &b = region.bounds;
+        if (x < b.x || x > b.x + b.w || y < b.y || y > b.y + b.h)
+            continue;
+        if (region.round)
+        {
+            float rx = b.w / 2.0f, ry = b.h / 2.0f;
+            float dx = (x - b.x - rx) / rx, dy = (y - b.y - ry) / ry;
+            if (dx * dx + dy * dy > 1.0f)
+                continue;
+        }
+        return region.id;
+    }
+    return HIT_NONE;
+}
+
+void pollInput(SDL_Window *win)
+{
+    pointer.moved = false;
+    pointer.pressed = false;
+    backendToggleRequested = false;
+
+    int winW, winH;
+    SDL_GetWindowSize(win, &winW, &winH);
+
+    SDL_Event e;
+    while (SDL_PollEvent(&e))
+    {
+        switch (e.type)
+        {
+        case SDL_QUIT:
+            pointer.quit = true;
+            break;
+        case SDL_KEYDOWN:
+            if (e.key.keysym.sym == SDLK_b && !e.key.repeat)
+                backendToggleRequested = true;
+            break;
+        case SDL_MOUSEMOTION:
+            // Touches are handled through the finger events below, skip every mouse copy of them
+            if (isTouchEcho(e.motion.which, e.motion.timestamp))
+                break;
+            pointer.x = e.motion.x;
+            pointer.y = e.motion.y;
+            pointer.moved = true;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+            if (isTouchEcho(e.button.which, e.button.timestamp) || e.button.button != SDL_BUTTON_LEFT || pointer.pressed)
+                break;
+            pointer.x = e.button.x;
+            pointer.y = e.button.y;
+            pointer.moved = true;
+            pointer.pressed = true;
+            pointer.pressX = e.button.x;
+            pointer.pressY = e.button.y;
+            pointer.pressTicks = e.button.timestamp;
+            break;
+        case SDL_FINGERMOTION:
+            fingerSeen = true;
+            lastFingerTicks = e.tfinger.timestamp;
+            pointer.x = int(e.tfinger.x * winW);
+            pointer.y = int(e.tfinger.y * winH);
+            pointer.moved = true;
+            break;
+        case SDL_FINGERDOWN:
+            fingerSeen = true;
+            lastFingerTicks = e.tfinger.timestamp;
+            pointer.x = int(e.tfinger.x * winW);
+            pointer.y = int(e.tfinger.y * winH);
+            pointer.moved = true;
+            if (pointer.pressed)
+                break;
+            pointer.pressed = true;
+            pointer.pressX = pointer.x;
+            pointer.pressY = pointer.y;
+            pointer.pressTicks = e.tfinger.timestamp;
+            break;
+        case SDL_FINGERUP:
+            fingerSeen = true;
+            lastFingerTicks = e.tfinger.timestamp;
+            // A lifted finger leaves no hover behind
+            pointer.x = -1;
+            pointer.y = -1;
+            pointer.moved = true;
+            break;
+        }
+    }
+
+    if (pointer.moved || hitRegionsDirty)
+    {
+        hoveredRegion = hitTest(pointer.x, pointer.y);
+        hitRegionsDirty = false;
+    }
+}
+
+void setCursor(SDL_Cursor *cursor)
+{
+    if (cursor == activeCursor)
+        return;
+    activeCursor = cursor;
+    SDL_SetCursor(cursor);
+}
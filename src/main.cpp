@@ -10,6 +10,9 @@
 #include "particles.cpp"
 #include "fetch.cpp"
 #include "utils.cpp"
+#include "profiler.cpp"
+#include "input.cpp"
+#include "gl_background.cpp"
 
 const SDL_Color titleColor = {83, 255, 170, 255};
 const SDL_Color quoteColor = {206, 227, 233, 255};
@@ -33,6 +36,24 @@ double prevWidth = -1, prevHeight = -1;
 int fontTitleSize;
 int fontQuoteSize;
 int fontButtonSize;
+bool glBackgroundReady = false;
+bool useGLBackground = false;
+const char *glBackgroundUnavailable = nullptr;
+std::string sdlBackgroundName = "sdl-accelerated";
+Uint64 lastFrameStart = 0;
+
+std::string backgroundBackendName()
+{
+    return useGLBackground ? "webgl" : sdlBackgroundName;
+}
+
+bool queryParamIs(const char *key, const char *value)
+{
+    return EM_ASM_INT({
+        var params = new URLSearchParams(window.location.search);
+        return params.get(UTF8ToString($0)) === UTF8ToString($1);
+    }, key, value);
+}
 
 std::vector<std::string> wrapText(const std::string &text, TTF_Font *font, int maxWidth)
 {
@@ -117,11 +138,16 @@ void updateViewWithFetchedData(std::string advice, std::string adviceId)
     SDL_DestroyTexture(textTitle);
     surfTitleText = "ADVICE #" + adviceId;
     surfQuoteText = advice;
+    profileStop("click-to-fetch");
 }
 
 void loop()
 {
-
+    Uint64 frameStart = SDL_GetPerformanceCounter();
+    // Start-to-start interval includes GL work the browser runs after loop() returns
+    if (lastFrameStart)
+        profileSample("interval (" + backgroundBackendName() + ")", (frameStart - lastFrameStart) * 1000.0 / SDL_GetPerformanceFrequency());
+    lastFrameStart = frameStart;
     Uint32 currentTicks = SDL_GetTicks();
     double dpr = emscripten_get_device_pixel_ratio();
     fontTitleSize = int(13 * dpr);
@@ -146,16 +172,28 @@ void loop()
         prevHeight = outerHeight;
         initStars(120, outerWidth, outerHeight);
         initWormhole(outerWidth, outerHeight);
+        uploadGLStars(stars);
     }
 
     SDL_SetWindowSize(win, outerWidth, outerHeight);
-    SDL_SetRenderDrawColor(renderer, 32, 39, 51, 255);
-    SDL_RenderClear(renderer);
-
-    updateStars(outerWidth, outerHeight);
-    updateWormhole(outerWidth, outerHeight);
-    renderStars(renderer);
-    renderWormhole(renderer);
+    if (useGLBackground)
+    {
+        // Background lives on #gl-canvas, leave the SDL canvas transparent above it
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        updateWormhole(outerWidth, outerHeight);
+        renderGLBackground(outerWidth, outerHeight, wormhole);
+    }
+    else
+    {
+        SDL_SetRenderDrawColor(renderer, 32, 39, 51, 255);
+        SDL_RenderClear(renderer);
+        updateStars(outerWidth, outerHeight);
+        updateWormhole(outerWidth, outerHeight);
+        renderStars(renderer);
+        renderWormhole(renderer);
+    }
     renderParticles(renderer);
     updateParticles();
     int dpr40 = int(40 * dpr);
@@ -177,31 +215,35 @@ void loop()
     buttonX = (innerWidth - buttonD) / 2 + contentX;
     buttonY = innerHeight + contentY - buttonD / 2;
 
-    SDL_Event e;
-    while (SDL_PollEvent(&e))
+    setHitRegion(HIT_BUTTON, {int(buttonX), int(buttonY), buttonD, buttonD}, true);
+    setHitRegion(HIT_CARD, innerWindow, false);
+    pollInput(win);
+
+    if (pointer.quit)
+        emscripten_cancel_main_loop();
+
+    if (backendToggleRequested && glBackgroundReady)
     {
-        if (e.type == SDL_QUIT)
-            emscripten_cancel_main_loop();
+        useGLBackground = !useGLBackground;
+        if (useGLBackground)
+            uploadGLStars(stars);
+        SDL_Log("background backend: %s", backgroundBackendName().c_str());
+    }
+    else if (backendToggleRequested)
+        SDL_Log("WebGL background unavailable (%s), staying on %s", glBackgroundUnavailable, sdlBackgroundName.c_str());
 
-        if (e.type == SDL_MOUSEBUTTONDOWN && e.button.button == SDL_BUTTON_LEFT)
-        {
-            int mx = e.button.x, my = e.button.y;
-            bool overBtn = mx >= buttonX && mx <= buttonX + buttonD && my >= buttonY && my <= buttonY + buttonD;
-            if (overBtn)
-            {
-
-                perform_fetch(updateViewWithFetchedData);
-                generateParticles(mx, my);
-            }
-        }
+    if (pointer.pressed && hitTest(pointer.pressX, pointer.pressY) == HIT_BUTTON)
+    {
+        profileStart("click-to-fetch", pointer.pressTicks);
+        perform_fetch(updateViewWithFetchedData, []
+                      { profileCancel("click-to-fetch"); });
+        generateParticles(pointer.pressX, pointer.pressY);
     }
 
     int dpr24 = int(24 * dpr);
     int dpr21 = int(21 * dpr);
-    int mx, my;
-    SDL_GetMouseState(&mx, &my);
-    bool overBtn = mx >= buttonX && mx <= buttonX + buttonD && my >= buttonY && my <= buttonY + buttonD;
-    SDL_SetCursor(overBtn ? handCursor : defaultCursor);
+    bool overBtn = hoveredRegion == HIT_BUTTON;
+    setCursor(overBtn ? handCursor : defaultCursor);
 
     drawCircle(renderer, outerWidth / 2, buttonY + buttonD / 2, buttonD / 2, {83, 255, 170, 25}, overBtn);
     SDL_Rect buttonRect = {int(buttonX) + dpr21, int(buttonY) + dpr21, dpr24, dpr24};
@@ -211,6 +253,9 @@ void loop()
     SDL_RenderCopy(renderer, patternTexture, NULL, &patternRect);
 
     SDL_RenderPresent(renderer);
+
+    double frameMs = (SDL_GetPerformanceCounter() - frameStart) * 1000.0 / SDL_GetPerformanceFrequency();
+    profileSample("frame (" + backgroundBackendName() + ")", frameMs);
 }
 
 int main()
@@ -229,7 +274,31 @@ int main()
     double outerHeight;
     emscripten_get_element_css_size("body", &outerWidth, &outerHeight);
     win = SDL_CreateWindow("Advice App Container", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, outerWidth, outerHeight, 0);
-    renderer = SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED);
+    // Transparent clears only show the WebGL background if the SDL canvas has an alpha channel
+    SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+    if (!queryParamIs("renderer", "software"))
+        renderer = SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED);
+    if (!renderer)
+        renderer = SDL_CreateRenderer(win, -1, SDL_RENDERER_SOFTWARE);
+
+    // The software renderer presents opaque pixels, so the WebGL background can only sit under an accelerated one
+    SDL_RendererInfo rendererInfo;
+    SDL_GetRendererInfo(renderer, &rendererInfo);
+    if (rendererInfo.flags & SDL_RENDERER_ACCELERATED)
+    {
+        glBackgroundReady = initGLBackground("#gl-canvas");
+        if (!glBackgroundReady)
+            glBackgroundUnavailable = "WebGL2 context or shaders could not be created";
+    }
+    else
+    {
+        sdlBackgroundName = "sdl-software";
+        glBackgroundUnavailable = "SDL is using the software renderer";
+    }
+    if (glBackgroundUnavailable)
+        SDL_Log("WebGL background disabled: %s", glBackgroundUnavailable);
+    useGLBackground = glBackgroundReady && queryParamIs("background", "webgl");
+    SDL_Log("background backend: %s", backgroundBackendName().c_str());
     buttonTexture = IMG_LoadTexture(renderer, "assets/images/icon-dice.png");
     patternTexture = IMG_LoadTexture(renderer, "assets/images/pattern-divider-desktop.png");
 
@@ -0,0 +1,66 @@
+#include <SDL2/SDL.h>
+#include <string>
+#include <map>
+#include <algorithm>
+
+struct ProfileStat
+{
+    Uint32 start = 0;
+    bool running = false;
+    Uint32 count = 0;
+    double last = 0;
+    double min = 0;
+    double max = 0;
+    double total = 0;
+};
+
+std::map<std::string, ProfileStat> profileStats;
+
+// Per-frame samples are only logged every this many frames to keep the console readable
+const Uint32 profileReportInterval = 300;
+
+void recordProfileSample(const std::string &name, ProfileStat &stat, double elapsed, Uint32 reportInterval)
+{
+    stat.last = elapsed;
+    stat.min = stat.count == 0 ? elapsed : std::min(stat.min, elapsed);
+    stat.max = std::max(stat.max, elapsed);
+    stat.total += elapsed;
+    stat.count++;
+
+    if (stat.count % reportInterval == 0)
+        SDL_Log("[profile] %s: %.2f ms (min %.2f, max %.2f, avg %.2f, n=%u)", name.c_str(), stat.last, stat.min, stat.max,
+                stat.total / stat.count, stat.count);
+}
+
+// Starts a named measurement; startTicks lets callers use an event timestamp instead of "now".
+// A measurement already in flight is kept, so the first start is paired with the next stop.
+void profileStart(const std::string &name, Uint32 startTicks)
+{
+    ProfileStat &stat = profileStats[name];
+    if (stat.running)
+        return;
+    stat.start = startTicks;
+    stat.running = true;
+}
+
+void profileStop(const std::string &name)
+{
+    auto it = profileStats.find(name);
+    if (it == profileStats.end() || !it->second.running)
+        return;
+
+    it->second.running = false;
+    recordProfileSample(name, it->second, SDL_GetTicks() - it->second.start, 1);
+}
+
+void profileCancel(const std::string &name)
+{
+    auto it = profileStats.find(name);
+    if (it != profileStats.end())
+        it->second.running = false;
+}
+
+void profileSample(const std::string &name, double elapsedMs)
+{
+    recordProfileSample(name, profileStats[name], elapsedMs, profileReportInterval);
+}